@@ -0,0 +1,72 @@
+#include <iostream>
+#include <iomanip>
+#include <filesystem>
+#include <chrono>
+#include <string>
+#include <vector>
+#include "Scene.hpp"
+#include "RayTracer.hpp"
+#include "ThreadPool.hpp"
+#include "PngEncoder.hpp"
+
+using namespace std;
+namespace fs = std::filesystem;
+
+// PNG encoding time of a rendered 2560x1440 frame: lodepng::encode as saveImage
+// used it before, against the strip encoder with each preset, on one thread and
+// on the pool.
+
+static const int WIDTH = 2560, HEIGHT = 1440;
+
+static double seconds(chrono::high_resolution_clock::time_point start)
+{
+    return chrono::duration<double>(chrono::high_resolution_clock::now() - start).count();
+}
+
+int main()
+{
+    fs::path scenePath = "assets/scenes/scene_3_meshes_triangular_light_mirror.xml";
+    if (!fs::exists(scenePath)) {
+        cerr << "[ERROR] Scene not found: " << scenePath << endl;
+        return 1;
+    }
+    fs::path dir = "build/bench";
+    fs::create_directories(dir);
+
+    ThreadPool pool;
+    Scene scene;
+    scene.parseScene(scenePath.string(), &pool);
+    scene.camera.imWidth = WIDTH;
+    scene.camera.imHeight = HEIGHT;
+    RayTracer rayTracer(scene, &pool);
+    rayTracer.renderMultithreaded();
+    vector<unsigned char> image = rayTracer.toneMappedImage();
+    double rawMB = (double)WIDTH * HEIGHT * 3 / 1e6;
+
+    cout << left << setw(36) << "encoder" << right << setw(12) << "ms" << setw(12) << "MB/s" << setw(12) << "KB" << endl;
+    auto row = [&](const string &name, double t, const fs::path &file) {
+        cout << left << setw(36) << name << right << fixed << setprecision(1) << setw(12) << t * 1e3
+             << setw(12) << rawMB / t << setw(12) << fs::file_size(file) / 1e3 << endl;
+    };
+
+    fs::path lodepngFile = dir / "png_lodepng.png";
+    auto start = chrono::high_resolution_clock::now();
+    lodepng::encode(lodepngFile.string(), image, WIDTH, HEIGHT);
+    row("lodepng", seconds(start), lodepngFile);
+
+    const char *presets[] = {"fast", "default", "small"};
+    for (const char *preset : presets) {
+        PngOptions options;
+        pngPreset(preset, options);
+        fs::path file = dir / (string("png_") + preset + ".png");
+
+        start = chrono::high_resolution_clock::now();
+        encodePng(file.string(), image, WIDTH, HEIGHT, options);
+        row(string("strips, ") + preset + ", 1 thread", seconds(start), file);
+
+        start = chrono::high_resolution_clock::now();
+        encodePng(file.string(), image, WIDTH, HEIGHT, options, &pool);
+        row(string("strips, ") + preset + ", " + to_string(pool.size()) + " threads", seconds(start), file);
+    }
+    return 0;
+}
@@ -0,0 +1,214 @@
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <sstream>
+#include <filesystem>
+#include <chrono>
+#include <string>
+#include <vector>
+#include "Scene.hpp"
+#include "ThreadPool.hpp"
+#include "SceneStreamLoader.hpp"
+#include <functional>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+using namespace std;
+using namespace tinyxml2;
+namespace fs = std::filesystem;
+
+// Load time of a synthetic scene with about a million triangles: a GRID x GRID
+// height field, two triangles per cell. The text parsing is compared with the
+// istringstream/stoi parsing parseScene used before the from_chars scanner.
+
+static const int GRID = 708; // 2 * 708^2 = 1,002,528 triangles
+
+static void writeSyntheticScene(const fs::path &path)
+{
+    ofstream out(path);
+    out << "<scene>\n<maxraytracedepth>1</maxraytracedepth>\n<background>0 0 0</background>\n"
+        << "<camera><position>0 0 2</position><gaze>0 0 -1</gaze><up>0 1 0</up>"
+        << "<nearPlane>-1 1 -1 1</nearPlane><neardistance>1</neardistance>"
+        << "<imageresolution>64 64</imageresolution></camera>\n"
+        << "<lights><ambientlight>25 25 25</ambientlight><pointlight id=\"1\"><position>0 0 2</position>"
+        << "<intensity>1000 1000 1000</intensity></pointlight></lights>\n"
+        << "<materials><material id=\"1\"><ambient>1 1 1</ambient><diffuse>1 1 1</diffuse>"
+        << "<specular>1 1 1</specular><phongexponent>1</phongexponent></material></materials>\n";
+
+    int n = GRID + 1;
+    out << setprecision(7) << "<vertexdata>\n";
+    for (int j = 0; j < n; j++)
+        for (int i = 0; i < n; i++)
+            out << (2.0 * i / GRID - 1) << " " << (2.0 * j / GRID - 1) << " " << 0.05 * sin(i * 0.1) * cos(j * 0.1) << "\n";
+    out << "</vertexdata>\n<texturedata>\n";
+    for (int j = 0; j < n; j++)
+        for (int i = 0; i < n; i++)
+            out << (double)i / GRID << " " << (double)j / GRID << "\n";
+    out << "</texturedata>\n<normaldata>\n";
+    for (int j = 0; j < n; j++)
+        for (int i = 0; i < n; i++)
+            out << "0 0 1\n";
+    out << "</normaldata>\n<objects><mesh id=\"1\"><materialid>1</materialid><faces>\n";
+    for (int j = 0; j < GRID; j++) {
+        for (int i = 0; i < GRID; i++) {
+            int a = j * n + i + 1, b = a + 1, c = a + n, d = c + 1;
+            out << a << "/" << a << "/" << a << " " << b << "/" << b << "/" << b << " " << d << "/" << d << "/" << d << "\n"
+                << a << "/" << a << "/" << a << " " << d << "/" << d << "/" << d << " " << c << "/" << c << "/" << c << "\n";
+        }
+    }
+    out << "</faces></mesh></objects>\n</scene>\n";
+}
+
+// the text parsing parseScene did before, kept here as the reference
+static size_t parseWithStreams(XMLElement *root)
+{
+    size_t items = 0;
+    const char *lists[] = {"vertexdata", "normaldata"};
+    for (const char *name : lists) {
+        istringstream iss(root->FirstChildElement(name)->GetText());
+        Real x, y, z;
+        vector<Vector3> values;
+        while (iss >> x >> y >> z) values.push_back(Vector3(x, y, z));
+        items += values.size();
+    }
+    {
+        istringstream iss(root->FirstChildElement("texturedata")->GetText());
+        Real u, v;
+        vector<Vector2> values;
+        while (iss >> u >> v) values.push_back(Vector2(u, v));
+        items += values.size();
+    }
+    XMLElement *facesElem = root->FirstChildElement("objects")->FirstChildElement("mesh")->FirstChildElement("faces");
+    istringstream iss(facesElem->GetText());
+    string token;
+    vector<Face> faces;
+    while (iss >> token) {
+        Face face;
+        for (int i = 0; i < 3; i++) {
+            size_t pos1 = token.find('/');
+            size_t pos2 = token.find('/', pos1 + 1);
+            face.v[i] = stoi(token.substr(0, pos1)) - 1;
+            face.t[i] = stoi(token.substr(pos1 + 1, pos2 - pos1 - 1)) - 1;
+            face.n[i] = stoi(token.substr(pos2 + 1)) - 1;
+            if (i < 2) iss >> token;
+        }
+        faces.push_back(face);
+    }
+    return items + faces.size();
+}
+
+static double seconds(chrono::high_resolution_clock::time_point start)
+{
+    return chrono::duration<double>(chrono::high_resolution_clock::now() - start).count();
+}
+
+// runs load in a child process and returns its time and the growth of the peak RSS in MB,
+// so the loaders don't see each other's memory
+static void measureInChild(const function<void()> &load, double &time, double &peakMB)
+{
+    int fds[2];
+    if (pipe(fds) != 0) return;
+    pid_t pid = fork();
+    if (pid == 0) {
+        struct rusage before, after;
+        getrusage(RUSAGE_SELF, &before);
+        auto start = chrono::high_resolution_clock::now();
+        load();
+        double result[2] = {seconds(start), 0.0};
+        getrusage(RUSAGE_SELF, &after);
+        result[1] = (after.ru_maxrss - before.ru_maxrss) / 1024.0; // ru_maxrss is in KB
+        ssize_t written = write(fds[1], result, sizeof(result));
+        _exit(written == sizeof(result) ? 0 : 1);
+    }
+    double result[2] = {0.0, 0.0};
+    if (read(fds[0], result, sizeof(result)) != sizeof(result)) cerr << "[ERROR] Measurement failed" << endl;
+    waitpid(pid, nullptr, 0);
+    close(fds[0]);
+    close(fds[1]);
+    time = result[0];
+    peakMB = result[1];
+}
+
+int main()
+{
+    fs::path dir = "build/bench";
+    fs::create_directories(dir);
+    fs::path scenePath = dir / "synthetic_scene.xml";
+    writeSyntheticScene(scenePath);
+    double fileMB = fs::file_size(scenePath) / 1e6;
+
+    // the text stage alone (the BVH build that follows is the same for both), measured
+    // before this process allocates anything the children could reuse
+    double domTime, domPeak, streamLoadTime, streamPeak;
+    measureInChild([&]() {
+        XMLDocument d;
+        d.LoadFile(scenePath.string().c_str());
+        Scene s;
+        s.parseSceneElements(d.FirstChildElement("scene"));
+    }, domTime, domPeak);
+    measureInChild([&]() { Scene s; SceneStreamLoader().loadElements(scenePath.string(), s); }, streamLoadTime, streamPeak);
+
+    // tinyxml2 alone, what is left is the bulk text parsing and the BVH
+    auto start = chrono::high_resolution_clock::now();
+    XMLDocument doc;
+    doc.LoadFile(scenePath.string().c_str());
+    double xmlTime = seconds(start);
+
+    start = chrono::high_resolution_clock::now();
+    size_t items = parseWithStreams(doc.FirstChildElement("scene"));
+    double streamTime = seconds(start);
+
+    start = chrono::high_resolution_clock::now();
+    Scene scene;
+    scene.parseScene(scenePath.string());
+    double loadTime = seconds(start);
+
+    start = chrono::high_resolution_clock::now();
+    scene.buildBVH();
+    double bvhTime = seconds(start);
+    double scanTime = loadTime - xmlTime - bvhTime;
+
+    // the same with the text split into chunks parsed on all hardware threads
+    ThreadPool pool;
+    start = chrono::high_resolution_clock::now();
+    Scene pooledScene;
+    pooledScene.parseScene(scenePath.string(), &pool);
+    double pooledTime = seconds(start);
+    double pooledScanTime = pooledTime - xmlTime - bvhTime;
+
+    cout << "Synthetic scene: " << scene.data().primitives.size() << " triangles, " << fixed << setprecision(1)
+         << fileMB << " MB of XML, " << items << " parsed items" << endl;
+    cout << left << setw(32) << "stage" << right << setw(12) << "ms" << setw(12) << "MB/s" << endl;
+    auto row = [&](const string &name, double t) {
+        cout << left << setw(32) << name << right << setprecision(1) << setw(12) << t * 1e3
+             << setw(12) << fileMB / t << endl;
+    };
+    row("tinyxml2 load", xmlTime);
+    row("istringstream/stoi parse", streamTime);
+    row("from_chars parse", scanTime);
+    row("from_chars parse, " + to_string(pool.size()) + " threads", pooledScanTime);
+    row("BVH build", bvhTime);
+    row("parseScene total", loadTime);
+    row("parseScene total, " + to_string(pool.size()) + " threads", pooledTime);
+
+    const SceneData &data = scene.data();
+    double geometryMB = (data.vertices.size() * sizeof(Vector3) + data.normals.size() * sizeof(Vector3) +
+                         data.texcoords.size() * sizeof(Vector2) + data.meshes[0].faces.size() * sizeof(Face)) / 1e6;
+    cout << left << setw(32) << "text stage of the loader" << right << setw(12) << "ms" << setw(12) << "peak MB" << endl;
+    cout << left << setw(32) << "tinyxml2 DOM + parse" << right << setw(12) << domTime * 1e3 << setw(12) << domPeak << endl;
+    cout << left << setw(32) << "SceneStreamLoader" << right << setw(12) << streamLoadTime * 1e3 << setw(12) << streamPeak << endl;
+    cout << "parsed geometry: " << geometryMB << " MB" << endl;
+
+    // another view of the same scene, e.g. for a second camera, shares the loaded data
+    start = chrono::high_resolution_clock::now();
+    Scene view(scene);
+    view.camera.imWidth /= 2;
+    view.camera.imHeight /= 2;
+    double copyTime = seconds(start);
+    cout << "Scene copy: " << setprecision(1) << copyTime * 1e6 << " us, data shared: "
+         << (&view.data() == &scene.data() ? "yes" : "no") << endl;
+    cout << "from_chars speedup: " << setprecision(2) << streamTime / scanTime << "x, with "
+         << pool.size() << " threads: " << streamTime / pooledScanTime << "x" << endl;
+    return 0;
+}
@@ -0,0 +1,131 @@
+#include <iostream>
+#include <iomanip>
+#include <filesystem>
+#include <chrono>
+#include <vector>
+#include <string>
+#include "Scene.hpp"
+
+using namespace std;
+namespace fs = std::filesystem;
+
+// Compares the Moller-Trumbore kernel in Ray::intersectTriangle against the
+// area based routine it replaced, brute force over every triangle of every scene.
+
+static const int RAY_GRID = 64; // RAY_GRID x RAY_GRID primary rays per scene
+
+// the previous Ray::intersectTriangle, kept here as the baseline
+static bool intersectTriangleAreaBased(const Ray &ray, const Vector3 &v0, const Vector3 &v1, const Vector3 &v2,
+                                       double &t, double &alpha, double &beta)
+{
+    Vector3 N = cross(v1 - v0, v2 - v0);
+    double NdotDir = dot(N, ray.direction);
+    if (fabs(NdotDir) < EPSILON) return false;
+
+    double d = dot(N, v0);
+    t = (d - dot(N, ray.origin)) / NdotDir;
+    if (t < EPSILON) return false;
+
+    Vector3 P = ray.origin + ray.direction * t;
+    double fullArea = 0.5 * length(N);
+    if (fullArea < EPSILON) return false;
+
+    double area0 = 0.5 * length(cross(v1 - P, v2 - P));
+    double area1 = 0.5 * length(cross(v2 - P, v0 - P));
+    double area2 = 0.5 * length(cross(v0 - P, v1 - P));
+
+    alpha = area0 / fullArea;
+    beta  = area1 / fullArea;
+    double gamma = area2 / fullArea;
+
+    if (fabs(alpha + beta + gamma - 1.0) > 1e-3) return false;
+    if (alpha < 0 || beta < 0 || gamma < 0) return false;
+
+    return true;
+}
+
+struct Triangle {
+    Vector3 v0, v1, v2;
+};
+
+static vector<Ray> primaryRays(const Camera &cam)
+{
+    Vector3 m = cam.position - cam.w * cam.nearDistance;
+    Vector3 q = m + cam.u * cam.left + cam.v * cam.top;
+    vector<Ray> rays;
+    for (int j = 0; j < RAY_GRID; j++) {
+        for (int i = 0; i < RAY_GRID; i++) {
+            double s_u = (cam.right - cam.left) * ((i + 0.5) / RAY_GRID);
+            double s_v = (cam.top - cam.bottom) * ((j + 0.5) / RAY_GRID);
+            Vector3 imagePoint = q + cam.u * s_u - cam.v * s_v;
+            rays.push_back(Ray(cam.position, imagePoint - cam.position));
+        }
+    }
+    return rays;
+}
+
+// runs every ray against every triangle, returns the elapsed seconds
+template <typename Kernel>
+static double runKernel(const vector<Ray> &rays, const vector<Triangle> &tris, Kernel kernel, long &hits, double &tSum)
+{
+    hits = 0;
+    tSum = 0.0;
+    auto start = chrono::high_resolution_clock::now();
+    for (const Ray &ray : rays) {
+        for (const Triangle &tri : tris) {
+            double t, alpha, beta;
+            if (kernel(ray, tri, t, alpha, beta)) {
+                hits++;
+                tSum += t; // keeps the results alive
+            }
+        }
+    }
+    auto end = chrono::high_resolution_clock::now();
+    return chrono::duration<double>(end - start).count();
+}
+
+int main()
+{
+    fs::path sceneDir = "assets/scenes";
+    if (!fs::exists(sceneDir)) {
+        cerr << "[ERROR] Scene folder not found: " << sceneDir << endl;
+        return 1;
+    }
+
+    cout << left << setw(44) << "scene" << right << setw(10) << "tris"
+         << setw(14) << "area Mt/s" << setw(14) << "MT Mt/s" << setw(10) << "speedup"
+         << setw(12) << "area hits" << setw(12) << "MT hits" << endl;
+
+    for (const auto &entry : fs::directory_iterator(sceneDir)) {
+        if (entry.path().extension() != ".xml") continue;
+
+        Scene scene;
+        scene.parseScene(entry.path().string());
+
+        const SceneData &data = scene.data();
+        vector<Triangle> tris;
+        for (const Mesh &mesh : data.meshes) {
+            for (const Face &face : mesh.faces) {
+                tris.push_back(Triangle{data.vertices[face.v[0]], data.vertices[face.v[1]], data.vertices[face.v[2]]});
+            }
+        }
+        vector<Ray> rays = primaryRays(scene.camera);
+        double tests = (double)rays.size() * tris.size();
+
+        long areaHits, mtHits;
+        double areaT, mtT;
+        double areaTime = runKernel(rays, tris, [](const Ray &r, const Triangle &tri, double &t, double &a, double &b) {
+            return intersectTriangleAreaBased(r, tri.v0, tri.v1, tri.v2, t, a, b);
+        }, areaHits, areaT);
+        double mtTime = runKernel(rays, tris, [](const Ray &r, const Triangle &tri, double &t, double &a, double &b) {
+            return r.intersectTriangle(tri.v0, tri.v1, tri.v2, t, a, b);
+        }, mtHits, mtT);
+
+        cout << left << setw(44) << entry.path().filename().string() << right << setw(10) << tris.size()
+             << fixed << setprecision(1)
+             << setw(14) << tests / areaTime * 1e-6 << setw(14) << tests / mtTime * 1e-6
+             << setprecision(2) << setw(9) << areaTime / mtTime << "x"
+             << setw(12) << areaHits << setw(12) << mtHits << endl;
+    }
+    return 0;
+}
@@ -0,0 +1,85 @@
+#include <iostream>
+#include <iomanip>
+#include <filesystem>
+#include <chrono>
+#include <limits>
+#include <vector>
+#include <string>
+#include "Scene.hpp"
+#include "TriangleKernels.hpp"
+
+using namespace std;
+namespace fs = std::filesystem;
+
+// Triangles tested per second by each SIMD level of the triangle kernels,
+// brute force over the TriangleStore blocks of every scene.
+
+static const int RAY_GRID = 64;       // RAY_GRID x RAY_GRID primary rays per scene
+static const int BLOCKS_PER_CALL = 2; // like a full BVH leaf
+
+static vector<Ray> primaryRays(const Camera &cam)
+{
+    Vector3 m = cam.position - cam.w * cam.nearDistance;
+    Vector3 q = m + cam.u * cam.left + cam.v * cam.top;
+    vector<Ray> rays;
+    for (int j = 0; j < RAY_GRID; j++) {
+        for (int i = 0; i < RAY_GRID; i++) {
+            Real s_u = (cam.right - cam.left) * ((i + Real(0.5)) / RAY_GRID);
+            Real s_v = (cam.top - cam.bottom) * ((j + Real(0.5)) / RAY_GRID);
+            Vector3 imagePoint = q + cam.u * s_u - cam.v * s_v;
+            rays.push_back(Ray(cam.position, imagePoint - cam.position));
+        }
+    }
+    return rays;
+}
+
+int main()
+{
+    fs::path sceneDir = "assets/scenes";
+    if (!fs::exists(sceneDir)) {
+        cerr << "[ERROR] Scene folder not found: " << sceneDir << endl;
+        return 1;
+    }
+
+    cout << "Detected SIMD level: " << triangleKernels(detectSimdLevel())->name
+         << ", " << TRIANGLE_BLOCK_WIDTH << " triangles per block" << endl;
+    cout << left << setw(44) << "scene" << setw(10) << "level" << right << setw(14) << "Mtris/s"
+         << setw(10) << "speedup" << setw(10) << "hits" << endl;
+
+    for (const auto &entry : fs::directory_iterator(sceneDir)) {
+        if (entry.path().extension() != ".xml") continue;
+
+        Scene scene;
+        scene.parseScene(entry.path().string());
+        const vector<TriangleBlock> &blocks = scene.data().triangles.blocks;
+        int numBlocks = (int)blocks.size();
+        vector<Ray> rays = primaryRays(scene.camera);
+        double tests = (double)rays.size() * scene.data().primitives.size();
+
+        double scalarTime = 0.0;
+        for (int level = SIMD_SCALAR; level < SIMD_LEVEL_COUNT; level++) {
+            const TriangleKernels *kernels = triangleKernels((SimdLevel)level);
+            if (!kernels) continue;
+
+            long hits = 0;
+            auto start = chrono::high_resolution_clock::now();
+            for (const Ray &ray : rays) {
+                for (int b = 0; b < numBlocks; b += BLOCKS_PER_CALL) {
+                    Real t, alpha, beta;
+                    int count = min(BLOCKS_PER_CALL, numBlocks - b);
+                    if (kernels->intersect(&blocks[b], count, ray, numeric_limits<Real>::max(), t, alpha, beta) >= 0) {
+                        hits++;
+                    }
+                }
+            }
+            auto end = chrono::high_resolution_clock::now();
+            double elapsed = chrono::duration<double>(end - start).count();
+            if (level == SIMD_SCALAR) scalarTime = elapsed;
+
+            cout << left << setw(44) << entry.path().filename().string() << setw(10) << kernels->name
+                 << right << fixed << setprecision(1) << setw(14) << tests / elapsed * 1e-6
+                 << setprecision(2) << setw(9) << scalarTime / elapsed << "x" << setw(10) << hits << endl;
+        }
+    }
+    return 0;
+}